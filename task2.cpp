@@ -10,17 +10,37 @@
 #include <windows.h>
 #include <iomanip>
 #include <algorithm>
+#include <functional>
+#include <sstream>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include <filesystem>
 
 using namespace std;
 
 // ==========================================
 //              CONFIGURATION
 // ==========================================
-#define MAX 200
-#define HASH_SIZE 101
+#define MAX 100000
+#define HASH_SIZE 131071
 #define PRINTERS 5
 #define JOB_FILE "jobs.txt"
 #define USER_FILE "users.txt"
+#define USER_JOURNAL "users.journal"
+#define PASSWORD_ROUNDS 1000
+#define JOURNAL_COMPACT_AT 1000
+#define PASSWORD_ENV "SPOOLER_PASSWORD"
+#define HISTORY_DIR "history"
+#define JOB_TYPES 4
+#define WAIT_BUCKETS 240
+#define HOUR_MS 3600000LL
+#define FAULT_RATE 0.05
+#define BREAKER_COOLDOWN_MS 2000
 
 enum ThemeType { MODERN, CLASSIC, DARK, LIGHT };
 
@@ -149,15 +169,33 @@ HANDLE UI::hConsole;
 //          CORE DATA STRUCTURES
 // ==========================================
 
+inline long long epochMs() {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Atomically swaps a fully written temp file over its target.
+inline bool replaceFile(const string& from, const string& to) {
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+
 struct PrintJob {
     string jobID, type, status, reason;
+    string owner;
     int priority;
     int timeRemaining;
     string timestamp;
-
-    PrintJob(string id = "", string t = "", int prio = 0) {
-        jobID = id; type = t; priority = prio;
+    long long submittedMs;
+    long long readyAt;  // simulated time of the last interrupted attempt; no retry before it
+    long long seq;  // submission order, the tie-break among equal priorities
+    int queue;      // owner's queue in the FairScheduler
+    int heapIndex;  // position inside that queue's heap
+
+    PrintJob(string id = "", string t = "", int prio = 0, string user = "system") {
+        jobID = id; type = t; priority = prio; owner = user;
         status = "Queued"; reason = "None";
+        queue = -1; heapIndex = -1; seq = -1;
+        submittedMs = epochMs();
+        readyAt = 0;
         if (type == "PDF") timeRemaining = 5 + (rand() % 10);
         else if (type == "IMG") timeRemaining = 8 + (rand() % 15);
         else timeRemaining = 2 + (rand() % 5);
@@ -186,7 +224,8 @@ struct PrintJob {
         cout << "  " << UI::text() << left << setw(8) << jobID
             << getTypeIcon() << " " << setw(5) << type
             << getPriorityColor() << setw(5) << priority << UI::reset()
-            << "   " << setw(10) << timestamp;
+            << "   " << setw(10) << timestamp
+            << UI::text() << setw(12) << owner << UI::reset();
 
         if (status == "Delayed")
             cout << UI::error() << setw(10) << status << UI::reset() << " (" << reason << ")";
@@ -200,25 +239,27 @@ struct PrintJob {
 
 struct HashNode {
     string jobID;
-    int heapIndex;
+    PrintJob* job;
     HashNode* next;
-    HashNode(string id, int idx) : jobID(id), heapIndex(idx), next(nullptr) {}
+    HashNode(string id, PrintJob* j) : jobID(id), job(j), next(nullptr) {}
 };
 
+// HASH_SIZE is a prime above MAX, so chains stay about one entry long even
+// with a full queue. The buckets live on the heap to keep the scheduler small.
 class HashTable {
 private:
-    HashNode* table[HASH_SIZE];
+    vector<HashNode*> table;
     int hashFunction(const string& jobID) {
-        int sum = 0;
-        for (char c : jobID) sum += c;
-        return sum % HASH_SIZE;
+        unsigned int h = 0;
+        for (char c : jobID) h = h * 31 + (unsigned char)c;
+        return h % HASH_SIZE;
     }
 public:
-    HashTable() { for (int i = 0; i < HASH_SIZE; i++) table[i] = nullptr; }
+    HashTable() : table(HASH_SIZE, nullptr) {}
 
-    void insert(string jobID, int heapIndex) {
+    void insert(string jobID, PrintJob* job) {
         int key = hashFunction(jobID);
-        HashNode* newNode = new HashNode(jobID, heapIndex);
+        HashNode* newNode = new HashNode(jobID, job);
         newNode->next = table[key];
         table[key] = newNode;
     }
@@ -233,11 +274,6 @@ public:
         return nullptr;
     }
 
-    void update(string jobID, int newIndex) {
-        HashNode* node = find(jobID);
-        if (node) node->heapIndex = newIndex;
-    }
-
     void remove(string jobID) {
         int key = hashFunction(jobID);
         HashNode* cur = table[key];
@@ -315,66 +351,950 @@ public:
     }
 };
 
-class MinHeap {
+// ==========================================
+//          FAIR-SHARE SCHEDULER
+// ==========================================
+
+// One ready queue per submitting user. Jobs sit in a min-heap by priority,
+// with Delayed jobs sinking below every Queued one so the head is always
+// printable whenever the user has anything printable at all.
+struct UserQueue {
+    string user;
+    double vtime;   // virtual start time of this user's next dispatch
+    int slot;       // position in the active-user heap, -1 when idle
+    vector<PrintJob*> heap;
+    UserQueue(string u) : user(u), vtime(0), slot(-1) {}
+};
+
+// Start-time fair queuing over the per-user heaps. Each dispatch charges the
+// user the job's print time in virtual time and the user with the smallest
+// virtual time prints next, so a tenant flooding priority-1 jobs only ever
+// gets its share of the printers. Dispatch is O(log users + log jobs).
+class FairScheduler {
 private:
-    PrintJob* heap[MAX];
-    int size;
-    int nextID;
+    vector<UserQueue*> queues;
+    unordered_map<string, int> queueIndex;
+    vector<int> active;     // min-heap of runnable queues by virtual time
     HashTable map;
+    double virtualTime;
+    int count;
+    long long nextSeq;
 
-    string generateJobID(const string& type) {
-        string code = "";
-        for (size_t i = 0; i < 3 && i < type.length(); i++) code += toupper(type[i]);
-        code += to_string(nextID++);
-        return code;
+    static bool ready(const PrintJob* job) { return job->status != "Delayed"; }
+
+    static bool jobBefore(const PrintJob* a, const PrintJob* b) {
+        if (ready(a) != ready(b)) return ready(a);
+        if (a->priority != b->priority) return a->priority < b->priority;
+        return a->seq < b->seq;
+    }
+
+    bool queueBefore(int a, int b) {
+        UserQueue* qa = queues[a];
+        UserQueue* qb = queues[b];
+        if (qa->vtime != qb->vtime) return qa->vtime < qb->vtime;
+        return qa->heap[0]->priority < qb->heap[0]->priority;
+    }
+
+    void swapJobs(UserQueue* q, int i, int j) {
+        PrintJob* temp = q->heap[i];
+        q->heap[i] = q->heap[j];
+        q->heap[j] = temp;
+        q->heap[i]->heapIndex = i;
+        q->heap[j]->heapIndex = j;
+    }
+
+    void siftUp(UserQueue* q, int index) {
+        while (index > 0) {
+            int parent = (index - 1) / 2;
+            if (jobBefore(q->heap[index], q->heap[parent])) {
+                swapJobs(q, index, parent);
+                index = parent;
+            }
+            else break;
+        }
+    }
+
+    void siftDown(UserQueue* q, int index) {
+        int n = q->heap.size();
+        while (true) {
+            int left = 2 * index + 1;
+            int right = 2 * index + 2;
+            int smallest = index;
+            if (left < n && jobBefore(q->heap[left], q->heap[smallest])) smallest = left;
+            if (right < n && jobBefore(q->heap[right], q->heap[smallest])) smallest = right;
+            if (smallest != index) {
+                swapJobs(q, index, smallest);
+                index = smallest;
+            }
+            else break;
+        }
     }
 
-    void swapJobs(int i, int j) {
-        PrintJob* temp = heap[i];
-        heap[i] = heap[j];
-        heap[j] = temp;
-        map.update(heap[i]->jobID, i);
-        map.update(heap[j]->jobID, j);
+    void swapQueues(int i, int j) {
+        int temp = active[i];
+        active[i] = active[j];
+        active[j] = temp;
+        queues[active[i]]->slot = i;
+        queues[active[j]]->slot = j;
     }
 
-    void siftUp(int index) {
+    void siftUpQueue(int index) {
         while (index > 0) {
             int parent = (index - 1) / 2;
-            if (heap[index]->priority < heap[parent]->priority) {
-                swapJobs(index, parent);
+            if (queueBefore(active[index], active[parent])) {
+                swapQueues(index, parent);
                 index = parent;
             }
             else break;
         }
     }
 
-    void siftDown(int index) {
+    void siftDownQueue(int index) {
+        int n = active.size();
         while (true) {
             int left = 2 * index + 1;
             int right = 2 * index + 2;
             int smallest = index;
-            if (left < size && heap[left]->priority < heap[smallest]->priority) smallest = left;
-            if (right < size && heap[right]->priority < heap[smallest]->priority) smallest = right;
+            if (left < n && queueBefore(active[left], active[smallest])) smallest = left;
+            if (right < n && queueBefore(active[right], active[smallest])) smallest = right;
             if (smallest != index) {
-                swapJobs(index, smallest);
+                swapQueues(index, smallest);
                 index = smallest;
             }
             else break;
         }
     }
 
+    int queueFor(const string& user) {
+        auto it = queueIndex.find(user);
+        if (it != queueIndex.end()) return it->second;
+        queues.push_back(new UserQueue(user));
+        queueIndex[user] = queues.size() - 1;
+        return queues.size() - 1;
+    }
+
+    // Re-seat a user in the active heap after its head job changed.
+    void refresh(int id) {
+        UserQueue* q = queues[id];
+        bool runnable = !q->heap.empty() && ready(q->heap[0]);
+        if (runnable && q->slot == -1) {
+            if (q->vtime < virtualTime) q->vtime = virtualTime; // no credit for idle time
+            q->slot = active.size();
+            active.push_back(id);
+            siftUpQueue(q->slot);
+        }
+        else if (!runnable && q->slot != -1) {
+            int s = q->slot;
+            swapQueues(s, active.size() - 1);
+            active.pop_back();
+            q->slot = -1;
+            if (s < (int)active.size()) {
+                int moved = active[s];
+                siftUpQueue(s);
+                siftDownQueue(queues[moved]->slot);
+            }
+        }
+        else if (runnable) {
+            siftUpQueue(q->slot);
+            siftDownQueue(q->slot);
+        }
+    }
+
+public:
+    FairScheduler() { virtualTime = 0; count = 0; nextSeq = 0; }
+    ~FairScheduler() {
+        for (UserQueue* q : queues) {
+            for (PrintJob* job : q->heap) delete job;
+            delete q;
+        }
+    }
+
+    int size() const { return count; }
+    bool hasReady() const { return !active.empty(); }
+
+    int delayedCount() const {
+        int n = 0;
+        for (UserQueue* q : queues)
+            for (PrintJob* job : q->heap) if (!ready(job)) n++;
+        return n;
+    }
+
+    void submit(PrintJob* job) {
+        int id = queueFor(job->owner);
+        UserQueue* q = queues[id];
+        if (job->seq < 0) job->seq = nextSeq++;
+        job->queue = id;
+        job->heapIndex = q->heap.size();
+        q->heap.push_back(job);
+        map.insert(job->jobID, job);
+        siftUp(q, job->heapIndex);
+        count++;
+        refresh(id);
+    }
+
+    PrintJob* find(const string& jobID) {
+        HashNode* node = map.find(jobID);
+        return node ? node->job : nullptr;
+    }
+
+    // Call after changing a queued job's priority or status.
+    void update(PrintJob* job) {
+        UserQueue* q = queues[job->queue];
+        siftUp(q, job->heapIndex);
+        siftDown(q, job->heapIndex);
+        refresh(job->queue);
+    }
+
+    // Unlinks the job and hands ownership back to the caller.
+    PrintJob* remove(PrintJob* job) {
+        UserQueue* q = queues[job->queue];
+        int idx = job->heapIndex;
+        swapJobs(q, idx, q->heap.size() - 1);
+        q->heap.pop_back();
+        if (idx < (int)q->heap.size()) {
+            PrintJob* moved = q->heap[idx];
+            siftUp(q, idx);
+            siftDown(q, moved->heapIndex);
+        }
+        map.remove(job->jobID);
+        count--;
+        refresh(job->queue);
+        return job;
+    }
+
+    // Next job to print across all users, or nullptr if nothing is Queued.
+    PrintJob* dispatch() {
+        if (active.empty()) return nullptr;
+        UserQueue* q = queues[active[0]];
+        PrintJob* job = q->heap[0];
+        virtualTime = q->vtime;
+        q->vtime += max(job->timeRemaining, 1);
+        return remove(job);
+    }
+
+    // Puts back a dispatched job whose print was interrupted. It keeps its
+    // priority and sequence number, so it lands where it was in its owner's
+    // heap, and the owner gets back the virtual time the dispatch charged.
+    void requeue(PrintJob* job) {
+        UserQueue* q = queues[job->queue];
+        q->vtime -= max(job->timeRemaining, 1);
+        submit(job);
+    }
+
+    vector<PrintJob*> jobs() const {
+        vector<PrintJob*> all;
+        all.reserve(count);
+        for (UserQueue* q : queues) all.insert(all.end(), q->heap.begin(), q->heap.end());
+        return all;
+    }
+};
+
+// ==========================================
+//              PRINTER FLEET
+// ==========================================
+
+// Same states as the dashboard's PrinterStatus. Scoped because windows.h
+// already defines ERROR.
+enum class PrinterStatus { Online, Offline, Maintenance, Error };
+
+struct PrinterUnit {
+    PrinterStatus status;
+    double faultRate;       // chance that a job dies mid-print (fault injection)
+    int failures;           // consecutive failed jobs
+    long long retryAt;      // while in Error, no jobs before this time
+    long long printed, interrupted;
+    vector<pair<long long, long long>> outages;    // scheduled Offline windows [from, to)
+    PrinterUnit() : status(PrinterStatus::Online), faultRate(0), failures(0), retryAt(0), printed(0), interrupted(0) {}
+};
+
+// Per-printer state with a circuit breaker: a failed job puts the printer in
+// Error and keeps it out of rotation for BREAKER_COOLDOWN_MS, doubling with
+// each consecutive failure. Once the cooldown passes the next job acts as the
+// health check. Success brings the printer back Online and failure re-opens
+// the breaker. Offline and Maintenance are operator-set and stay put.
+class PrinterFleet {
+private:
+    vector<PrinterUnit> units;
+
 public:
-    MinHeap() { size = 0; nextID = 1; loadFromFile(); }
-    ~MinHeap() { saveToFile(); }
+    PrinterFleet(int n = PRINTERS) : units(n) {}
+
+    int size() const { return units.size(); }
+
+    static const char* statusName(PrinterStatus s) {
+        switch (s) {
+        case PrinterStatus::Online: return "Online";
+        case PrinterStatus::Offline: return "Offline";
+        case PrinterStatus::Maintenance: return "Maintenance";
+        default: return "Error";
+        }
+    }
+
+    PrinterStatus status(int p) const { return units[p].status; }
+    const PrinterUnit& unit(int p) const { return units[p]; }
+
+    int onlineCount() const {
+        int n = 0;
+        for (const PrinterUnit& u : units) if (u.status == PrinterStatus::Online) n++;
+        return n;
+    }
+
+    void setStatus(int p, PrinterStatus s) {
+        units[p].status = s;
+        units[p].failures = 0;
+        units[p].retryAt = 0;
+    }
+
+    // Capped below 1 so a drain always makes progress eventually.
+    void setFaultRate(int p, double rate) { units[p].faultRate = min(max(rate, 0.0), 0.95); }
+
+    void scheduleOutage(int p, long long fromMs, long long toMs) {
+        units[p].outages.push_back({ fromMs, toMs });
+        sort(units[p].outages.begin(), units[p].outages.end());
+    }
+
+    // Earliest time >= t at which printer p may take a job, or -1 if it
+    // will not come back on its own.
+    long long availableFrom(int p, long long t) const {
+        const PrinterUnit& u = units[p];
+        if (u.status == PrinterStatus::Offline || u.status == PrinterStatus::Maintenance) return -1;
+        if (u.status == PrinterStatus::Error && t < u.retryAt) t = u.retryAt;
+        for (const auto& w : u.outages)
+            if (t >= w.first && t < w.second) {
+                if (w.second == LLONG_MAX) return -1;
+                t = w.second;
+            }
+        return t;
+    }
+
+    // Start of the first outage that cuts into [startMs, endMs), or -1.
+    long long outageDuring(int p, long long startMs, long long endMs) const {
+        for (const auto& w : units[p].outages)
+            if (w.first > startMs && w.first < endMs) return w.first;
+        return -1;
+    }
+
+    bool injectFault(int p) const {
+        return units[p].faultRate > 0 && rand() < units[p].faultRate * RAND_MAX;
+    }
+
+    void reportSuccess(int p) {
+        PrinterUnit& u = units[p];
+        u.status = PrinterStatus::Online;
+        u.failures = 0;
+        u.printed++;
+    }
+
+    // Opens the breaker without blaming a job, e.g. an operator marking the
+    // printer as faulted.
+    void tripBreaker(int p, long long nowMs) {
+        PrinterUnit& u = units[p];
+        u.status = PrinterStatus::Error;
+        u.retryAt = nowMs + ((long long)BREAKER_COOLDOWN_MS << min(u.failures, 6));
+        u.failures++;
+    }
 
-    int getJobCount() { return size; }
-    int getDelayedCount() {
-        int count = 0;
-        for (int i = 0; i < size; i++) if (heap[i]->status == "Delayed") count++;
-        return count;
+    void reportFailure(int p, long long nowMs) {
+        tripBreaker(p, nowMs);
+        units[p].interrupted++;
+    }
+
+    void reportInterrupted(int p) { units[p].interrupted++; }
+
+    // Earliest breaker retry among printers in Error, or -1 if none.
+    long long nextRetry() const {
+        long long best = -1;
+        for (const PrinterUnit& u : units)
+            if (u.status == PrinterStatus::Error && (best < 0 || u.retryAt < best)) best = u.retryAt;
+        return best;
+    }
+
+    // Drains every ready job on a simulated clock starting at startMs, with
+    // faults and outages applied. Interrupted jobs go back to the scheduler
+    // and are picked up by whichever healthy printer frees up first, but
+    // never before the time they were interrupted.
+    // done(job, printer, start, end) takes ownership of each finished job.
+    // Returns when the last job finished, or when no printer is left.
+    long long drain(FairScheduler& sched, long long startMs, const function<void(PrintJob*, int, long long, long long)>& done) {
+        vector<long long> freeAt(units.size(), startMs);
+        long long last = startMs;
+        while (sched.hasReady()) {
+            int p = -1;
+            long long at = LLONG_MAX;
+            for (int i = 0; i < (int)units.size(); i++) {
+                long long t = availableFrom(i, freeAt[i]);
+                if (t >= 0 && t < at) { at = t; p = i; }
+            }
+            if (p == -1) break;
+
+            PrintJob* job = sched.dispatch();
+            if (job->readyAt > at) {
+                at = availableFrom(p, job->readyAt);
+                if (at < 0) {
+                    // Printer p goes away before the job may restart.
+                    sched.requeue(job);
+                    freeAt[p] = LLONG_MAX;
+                    continue;
+                }
+            }
+            long long end = at + job->timeRemaining * 110LL; // same pace as the processJobs animation
+            long long cut = outageDuring(p, at, end);
+            if (cut >= 0) {
+                reportInterrupted(p);
+                job->readyAt = cut;
+                sched.requeue(job);
+                freeAt[p] = cut;
+                continue;
+            }
+            if (injectFault(p)) {
+                long long failAt = at + (end - at) * (rand() % 100) / 100;
+                reportFailure(p, failAt);
+                job->readyAt = failAt;
+                sched.requeue(job);
+                freeAt[p] = failAt;
+                continue;
+            }
+            reportSuccess(p);
+            freeAt[p] = end;
+            last = max(last, end);
+            done(job, p, at, end);
+        }
+        return last;
+    }
+};
+
+// ==========================================
+//          COMPLETED-JOB HISTORY
+// ==========================================
+
+static const char* JOB_TYPE_NAMES[JOB_TYPES] = { "PDF", "IMG", "TXT", "DOC" };
+
+inline int jobTypeCode(const string& type) {
+    for (int i = 0; i < JOB_TYPES - 1; i++) if (type == JOB_TYPE_NAMES[i]) return i;
+    return JOB_TYPES - 1;
+}
+
+// Rollups for one hour, kept as plain data so the sidecar file can hold
+// them verbatim. They are updated on append, so a query only reads rows for
+// the hours its range cuts partway through.
+struct HistoryRollup {
+    long long hour;                 // finish time / HOUR_MS
+    uint32_t rows;
+    uint32_t typeCount[JOB_TYPES];
+    uint64_t typePrintMs[JOB_TYPES];
+    uint64_t printerBusyMs[PRINTERS];
+    uint32_t waitHist[5][WAIT_BUCKETS];
+};
+
+// One hour of finished jobs (by finish time), stored column by column. When
+// a partition is read back from disk only its rollup is loaded; the columns
+// follow on demand, e.g. when new rows land in that hour.
+struct HistoryPartition {
+    HistoryRollup roll;
+    bool columnsLoaded;
+    bool dirty;                     // rows appended since the last flush
+    int slot;                       // record index in rollups.bin, -1 if not there yet
+    vector<uint32_t> finishOffset;  // ms into the hour
+    vector<uint32_t> waitMs;        // submitted -> started
+    vector<uint32_t> printMs;       // started -> finished
+    vector<uint8_t> type, priority, printer;
+    vector<uint32_t> user;          // index into HistoryStore's user dictionary
+
+    HistoryPartition(long long h) {
+        memset(&roll, 0, sizeof(roll));
+        roll.hour = h;
+        columnsLoaded = true;
+        dirty = false;
+        slot = -1;
+    }
+};
+
+// Append-only store of finished jobs. Recording only touches memory; flush()
+// writes each changed hour to HISTORY_DIR/<hour>.bin (a row count followed by
+// the columns) and its rollup to a fixed-size record in HISTORY_DIR/rollups.bin,
+// so opening the store for a report reads one small file instead of every row.
+// User names live in HISTORY_DIR/users.txt, one per line, with the line number
+// as ID.
+class HistoryStore {
+private:
+    vector<HistoryPartition*> parts;    // sorted by hour
+    unordered_map<string, uint32_t> userIndex;
+    vector<string> userNames;
+    size_t savedUsers;                  // names already in users.txt
+    uint32_t sidecarSlots;              // records in rollups.bin
+    bool sidecarStale;                  // rollups.bin missing or unusable: rewrite it whole
+    string dir;
+    bool loaded;
+    long long rows;
+
+    // Log-linear buckets: exact below 8 ms, then 8 sub-buckets per power of
+    // two (<= 12.5% error), covering the full uint32 range.
+    static int bucketOf(uint32_t v) {
+        if (v < 8) return v;
+        int e = 3;
+        while (e < 31 && (v >> (e + 1)) != 0) e++;
+        return 8 + (e - 3) * 8 + ((v >> (e - 3)) & 7);
+    }
+
+    static uint32_t bucketFloor(int b) {
+        if (b < 8) return b;
+        int e = (b - 8) / 8 + 3;
+        return (uint32_t)(8 + (b - 8) % 8) << (e - 3);
+    }
+
+    static void addToRollup(HistoryRollup& r, uint32_t waitMs, uint32_t printMs, int type, int prio, int printer) {
+        r.rows++;
+        r.typeCount[type]++;
+        r.typePrintMs[type] += printMs;
+        if (printer >= 0 && printer < PRINTERS) r.printerBusyMs[printer] += printMs;
+        r.waitHist[prio - 1][bucketOf(waitMs)]++;
+    }
+
+    template <class T> static void writeColumn(ofstream& out, const vector<T>& col) {
+        out.write((const char*)col.data(), col.size() * sizeof(T));
+    }
+
+    template <class T> static void readColumn(ifstream& in, vector<T>& col, uint32_t n) {
+        col.resize(n);
+        in.read((char*)col.data(), n * sizeof(T));
+    }
+
+    // Bytes per row over all columns, so a partition file's row count can be
+    // checked against the sidecar from its size alone.
+    static const uint64_t ROW_BYTES = 4 + 4 + 4 + 1 + 1 + 1 + 4;
+
+    string partitionFile(long long hour) const { return dir + "/" + to_string(hour) + ".bin"; }
+
+    HistoryPartition* partitionFor(long long hour) {
+        if (!parts.empty() && parts.back()->roll.hour == hour) return parts.back();
+        auto it = lower_bound(parts.begin(), parts.end(), hour,
+            [](const HistoryPartition* p, long long h) { return p->roll.hour < h; });
+        if (it != parts.end() && (*it)->roll.hour == hour) return *it;
+        HistoryPartition* p = new HistoryPartition(hour);
+        // Never shadow rows already on disk: read them before the first append.
+        error_code ec;
+        if (!dir.empty() && filesystem::exists(partitionFile(hour), ec)) p->columnsLoaded = false;
+        return *parts.insert(it, p);
+    }
+
+    uint32_t userID(const string& name) {
+        auto it = userIndex.find(name);
+        if (it != userIndex.end()) return it->second;
+        userNames.push_back(name);
+        return userIndex[name] = userNames.size() - 1;
+    }
+
+    // Reads a partition's rows. If the file disagrees with the rollup (a
+    // crash between the column write and the sidecar write, or no sidecar),
+    // the rollup is rebuilt from the rows.
+    void ensureColumns(HistoryPartition* p) {
+        if (p->columnsLoaded) return;
+        p->columnsLoaded = true;
+        ifstream in(partitionFile(p->roll.hour), ios::binary);
+        uint32_t n = 0;
+        if (!in.read((char*)&n, sizeof(n))) n = 0;
+        readColumn(in, p->finishOffset, n);
+        readColumn(in, p->waitMs, n);
+        readColumn(in, p->printMs, n);
+        readColumn(in, p->type, n);
+        readColumn(in, p->priority, n);
+        readColumn(in, p->printer, n);
+        readColumn(in, p->user, n);
+        if (!in) {
+            n = 0;
+            p->finishOffset.clear(); p->waitMs.clear(); p->printMs.clear();
+            p->type.clear(); p->priority.clear(); p->printer.clear(); p->user.clear();
+        }
+        if (n == p->roll.rows) return;
+
+        rows -= p->roll.rows;
+        long long hour = p->roll.hour;
+        memset(&p->roll, 0, sizeof(p->roll));
+        p->roll.hour = hour;
+        for (uint32_t i = 0; i < n; i++)
+            addToRollup(p->roll, p->waitMs[i], p->printMs[i], min((int)p->type[i], JOB_TYPES - 1),
+                min(max((int)p->priority[i], 1), 5), p->printer[i]);
+        rows += n;
+        p->dirty = true;
+    }
+
+    // Reads the user dictionary and the rollup sidecar, then checks the
+    // sidecar against the partition files. An hour whose file is missing from
+    // it, or whose size disagrees with it (a crash between the two writes),
+    // is read and its rollup rebuilt; other rows stay on disk.
+    void ensureLoaded() {
+        if (loaded) return;
+        loaded = true;
+        if (dir.empty()) return;
+
+        ifstream names(dir + "/users.txt");
+        string name;
+        while (getline(names, name)) userID(name);
+        savedUsers = userNames.size();
+
+        ifstream in(dir + "/rollups.bin", ios::binary);
+        uint32_t header[2] = { 0, 0 };     // record size, record count
+        if (in.read((char*)header, sizeof(header)) && header[0] == sizeof(HistoryRollup)) {
+            for (uint32_t i = 0; i < header[1]; i++) {
+                HistoryPartition* p = new HistoryPartition(0);
+                if (!in.read((char*)&p->roll, sizeof(p->roll))) { delete p; break; }
+                p->columnsLoaded = false;
+                p->slot = i;
+                parts.push_back(p);
+                rows += p->roll.rows;
+            }
+            sidecarSlots = parts.size();
+            sidecarStale = false;
+            sort(parts.begin(), parts.end(), [](const HistoryPartition* a, const HistoryPartition* b) { return a->roll.hour < b->roll.hour; });
+        }
+
+        error_code ec;
+        unordered_map<long long, bool> onDisk;
+        for (const auto& entry : filesystem::directory_iterator(dir, ec)) {
+            string stem = entry.path().stem().string();
+            if (entry.path().extension() != ".bin" || stem.empty() || stem.find_first_not_of("0123456789") != string::npos) continue;
+            HistoryPartition* p = partitionFor(stoll(stem));
+            onDisk[p->roll.hour] = true;
+            uint64_t bytes = entry.file_size(ec);
+            if (ec || bytes < 4 || (bytes - 4) / ROW_BYTES != p->roll.rows) {
+                p->columnsLoaded = false;
+                ensureColumns(p);
+            }
+        }
+        for (HistoryPartition* p : parts)
+            if (p->roll.rows > 0 && !onDisk.count(p->roll.hour)) ensureColumns(p);
+    }
+
+    void clear() {
+        for (HistoryPartition* p : parts) delete p;
+        parts.clear();
+        userIndex.clear();
+        userNames.clear();
+        rows = 0;
+    }
+
+    // Partitions whose hour overlaps [fromMs, toMs).
+    pair<size_t, size_t> range(long long fromMs, long long toMs) const {
+        size_t lo = 0, hi = parts.size();
+        while (lo < hi && (parts[lo]->roll.hour + 1) * HOUR_MS <= fromMs) lo++;
+        while (hi > lo && parts[hi - 1]->roll.hour * HOUR_MS >= toMs) hi--;
+        return { lo, hi };
+    }
+
+    // The part of [fromMs, toMs) inside p's hour, as finishOffset bounds
+    // [lo, hi). True when that is the whole hour and the rollup answers on
+    // its own; otherwise p's columns are loaded for a scan.
+    bool wholeHour(HistoryPartition* p, long long fromMs, long long toMs, uint32_t& lo, uint32_t& hi) {
+        long long start = p->roll.hour * HOUR_MS;
+        lo = (uint32_t)max(fromMs - start, 0LL);
+        hi = (uint32_t)min(toMs - start, HOUR_MS);
+        if (lo == 0 && hi == HOUR_MS) return true;
+        ensureColumns(p);
+        return false;
+    }
+
+public:
+    struct HourCounts {
+        long long hour;
+        uint32_t count[JOB_TYPES];
+    };
+
+    // An empty path keeps everything in memory.
+    HistoryStore(string path = HISTORY_DIR) {
+        dir = path; loaded = false; rows = 0; savedUsers = 0;
+        sidecarSlots = 0; sidecarStale = true;
+    }
+    ~HistoryStore() { clear(); }
+
+    long long size() const { return rows; }
+
+    void append(long long finishedMs, uint32_t waitMs, uint32_t printMs, int type, int prio, int printer, const string& user) {
+        ensureLoaded();
+        HistoryPartition* p = partitionFor(finishedMs / HOUR_MS);
+        ensureColumns(p);
+        prio = min(max(prio, 1), 5);
+        p->finishOffset.push_back((uint32_t)(finishedMs % HOUR_MS));
+        p->waitMs.push_back(waitMs);
+        p->printMs.push_back(printMs);
+        p->type.push_back((uint8_t)type);
+        p->priority.push_back((uint8_t)prio);
+        p->printer.push_back((uint8_t)printer);
+        p->user.push_back(userID(user));
+        addToRollup(p->roll, waitMs, printMs, type, prio, printer);
+        p->dirty = true;
+        rows++;
+    }
+
+    void record(const PrintJob* job, int printer, long long startMs, long long endMs) {
+        uint32_t wait = (uint32_t)max(startMs - job->submittedMs, 0LL);
+        uint32_t print = (uint32_t)max(endMs - startMs, 0LL);
+        append(endMs, wait, print, jobTypeCode(job->type), job->priority, printer, job->owner);
+    }
+
+    // Writes changed hours, then their rollup records. A partition file is
+    // written to a temp name and swapped in; rollup records are rewritten in
+    // place, new ones appended, and the record count in the header goes last.
+    // Whatever a crash leaves behind is caught by the size check on open.
+    bool flush() {
+        if (dir.empty() || !loaded) return true;
+        bool anyDirty = sidecarStale;
+        for (HistoryPartition* p : parts) anyDirty = anyDirty || p->dirty;
+        if (!anyDirty) return true;
+
+        error_code ec;
+        filesystem::create_directories(dir, ec);
+        if (savedUsers < userNames.size()) {
+            ofstream names(dir + "/users.txt", ios::app);
+            for (size_t i = savedUsers; i < userNames.size(); i++) names << userNames[i] << "\n";
+            names.close();
+            if (names.fail()) return false;
+            savedUsers = userNames.size();
+        }
+
+        for (HistoryPartition* p : parts) {
+            if (!p->dirty) continue;
+            string file = partitionFile(p->roll.hour), tmp = file + ".tmp";
+            ofstream out(tmp, ios::binary | ios::trunc);
+            uint32_t n = p->finishOffset.size();
+            out.write((const char*)&n, sizeof(n));
+            writeColumn(out, p->finishOffset);
+            writeColumn(out, p->waitMs);
+            writeColumn(out, p->printMs);
+            writeColumn(out, p->type);
+            writeColumn(out, p->priority);
+            writeColumn(out, p->printer);
+            writeColumn(out, p->user);
+            out.close();
+            if (out.fail() || !replaceFile(tmp, file)) return false;
+        }
+
+        string file = dir + "/rollups.bin";
+        bool rewrite = sidecarStale;
+        if (rewrite) {
+            ofstream(file, ios::binary | ios::trunc).close();
+            sidecarSlots = 0;
+        }
+        fstream side(file, ios::in | ios::out | ios::binary);
+        if (!side.is_open()) return false;
+        for (HistoryPartition* p : parts) {
+            if (!p->dirty && !rewrite) continue;
+            if (rewrite || p->slot < 0) p->slot = sidecarSlots++;
+            side.seekp(2 * sizeof(uint32_t) + (uint64_t)p->slot * sizeof(HistoryRollup));
+            side.write((const char*)&p->roll, sizeof(p->roll));
+        }
+        uint32_t header[2] = { (uint32_t)sizeof(HistoryRollup), sidecarSlots };
+        side.seekp(0);
+        side.write((const char*)header, sizeof(header));
+        side.close();
+        if (side.fail()) return false;
+        for (HistoryPartition* p : parts) p->dirty = false;
+        sidecarStale = false;
+        return true;
+    }
+
+    // Opens the on-disk history for queries (rollups only).
+    void load() { ensureLoaded(); }
+
+    // Jobs finished per type for each hour in range. Edge hours are
+    // trimmed to the range exactly.
+    vector<HourCounts> throughputByHour(long long fromMs, long long toMs) {
+        vector<HourCounts> out;
+        auto r = range(fromMs, toMs);
+        for (size_t i = r.first; i < r.second; i++) {
+            HistoryPartition* p = parts[i];
+            HourCounts hc;
+            hc.hour = p->roll.hour;
+            uint32_t lo, hi;
+            if (wholeHour(p, fromMs, toMs, lo, hi)) memcpy(hc.count, p->roll.typeCount, sizeof(hc.count));
+            else {
+                const uint32_t* off = p->finishOffset.data();
+                const uint8_t* type = p->type.data();
+                size_t n = p->finishOffset.size();
+                for (int t = 0; t < JOB_TYPES; t++) {
+                    uint32_t c = 0;
+                    for (size_t j = 0; j < n; j++) c += (off[j] >= lo) & (off[j] < hi) & (type[j] == t);
+                    hc.count[t] = c;
+                }
+            }
+            out.push_back(hc);
+        }
+        return out;
+    }
+
+    // Approximate q-quantile of queue wait for one priority, in ms.
+    uint32_t waitPercentile(int prio, double q, long long fromMs, long long toMs, uint64_t* count = nullptr) {
+        uint64_t hist[WAIT_BUCKETS] = { 0 };
+        uint64_t total = 0;
+        auto r = range(fromMs, toMs);
+        for (size_t i = r.first; i < r.second; i++) {
+            HistoryPartition* p = parts[i];
+            uint32_t lo, hi;
+            if (wholeHour(p, fromMs, toMs, lo, hi)) {
+                const uint32_t* h = p->roll.waitHist[prio - 1];
+                for (int b = 0; b < WAIT_BUCKETS; b++) hist[b] += h[b];
+                continue;
+            }
+            for (size_t j = 0; j < p->finishOffset.size(); j++)
+                if (p->finishOffset[j] >= lo && p->finishOffset[j] < hi && p->priority[j] == prio) hist[bucketOf(p->waitMs[j])]++;
+        }
+        for (int b = 0; b < WAIT_BUCKETS; b++) total += hist[b];
+        if (count) *count = total;
+        if (total == 0) return 0;
+        uint64_t target = (uint64_t)(q * (total - 1)) + 1, seen = 0;
+        for (int b = 0; b < WAIT_BUCKETS; b++) {
+            seen += hist[b];
+            if (seen >= target) return bucketFloor(b);
+        }
+        return bucketFloor(WAIT_BUCKETS - 1);
+    }
+
+    // The edge-hour scans below are branch-free so the compiler can
+    // vectorise them.
+    double avgPrintMs(int type, long long fromMs, long long toMs) {
+        uint64_t n = 0, ms = 0;
+        auto r = range(fromMs, toMs);
+        for (size_t i = r.first; i < r.second; i++) {
+            HistoryPartition* p = parts[i];
+            uint32_t lo, hi;
+            if (wholeHour(p, fromMs, toMs, lo, hi)) {
+                n += p->roll.typeCount[type];
+                ms += p->roll.typePrintMs[type];
+                continue;
+            }
+            const uint32_t* off = p->finishOffset.data();
+            const uint32_t* print = p->printMs.data();
+            const uint8_t* t = p->type.data();
+            for (size_t j = 0; j < p->finishOffset.size(); j++) {
+                uint32_t hit = (off[j] >= lo) & (off[j] < hi) & (t[j] == type);
+                n += hit;
+                ms += print[j] * hit;
+            }
+        }
+        return n ? (double)ms / n : 0;
+    }
+
+    uint64_t printerBusyMs(int printer, long long fromMs, long long toMs) {
+        uint64_t busy = 0;
+        auto r = range(fromMs, toMs);
+        for (size_t i = r.first; i < r.second; i++) {
+            HistoryPartition* p = parts[i];
+            uint32_t lo, hi;
+            if (wholeHour(p, fromMs, toMs, lo, hi)) {
+                busy += p->roll.printerBusyMs[printer];
+                continue;
+            }
+            const uint32_t* off = p->finishOffset.data();
+            const uint32_t* print = p->printMs.data();
+            const uint8_t* pr = p->printer.data();
+            for (size_t j = 0; j < p->finishOffset.size(); j++)
+                busy += (uint64_t)print[j] * ((off[j] >= lo) & (off[j] < hi) & (pr[j] == printer));
+        }
+        return busy;
+    }
+
+    // Jobs finished per user in range, busiest first. There is no rollup for
+    // this, so it scans the user column of every hour in range.
+    vector<pair<string, uint64_t>> jobsByUser(long long fromMs, long long toMs) {
+        vector<uint64_t> counts(userNames.size(), 0);
+        auto r = range(fromMs, toMs);
+        for (size_t i = r.first; i < r.second; i++) {
+            HistoryPartition* p = parts[i];
+            uint32_t lo, hi;
+            wholeHour(p, fromMs, toMs, lo, hi);    // for the bounds; the column is read either way
+            ensureColumns(p);
+            for (size_t j = 0; j < p->finishOffset.size(); j++)
+                if (p->finishOffset[j] >= lo && p->finishOffset[j] < hi && p->user[j] < counts.size()) counts[p->user[j]]++;
+        }
+        vector<pair<string, uint64_t>> out;
+        for (size_t u = 0; u < counts.size(); u++)
+            if (counts[u]) out.push_back({ userNames[u], counts[u] });
+        sort(out.begin(), out.end(), [](const pair<string, uint64_t>& a, const pair<string, uint64_t>& b) { return a.second > b.second; });
+        return out;
+    }
+};
+
+class MinHeap {
+private:
+    FairScheduler sched;
+    HistoryStore history;
+    PrinterFleet fleet;
+    int nextID;
+    string currentUser;
+
+    string generateJobID(const string& type) {
+        string code = "";
+        for (size_t i = 0; i < 3 && i < type.length(); i++) code += toupper(type[i]);
+        code += to_string(nextID++);
+        return code;
     }
 
+public:
+    MinHeap(string user = "system") { nextID = 1; currentUser = user; loadFromFile(); }
+    ~MinHeap() { saveToFile(); history.flush(); }
+
+    int getJobCount() { return sched.size(); }
+    int getDelayedCount() { return sched.delayedCount(); }
+    vector<PrintJob*> getJobs() { return sched.jobs(); }
+    const PrintJob* getJob(const string& id) { return sched.find(id); }
+    PrinterFleet& getFleet() { return fleet; }
+
+    // ---- Core operations without UI (shared by the menus and batch mode) ----
+
+    // Returns the new job ID, or "" when the queue is full.
+    // prio must already be 1-5; callers decide how to treat bad input.
+    string submit(const string& type, int prio, const string& owner) {
+        if (sched.size() >= MAX) return "";
+        string id = generateJobID(type);
+        sched.submit(new PrintJob(id, type, prio, owner));
+        return id;
+    }
+
+    bool cancel(const string& id) {
+        PrintJob* job = sched.find(id);
+        if (!job) return false;
+        delete sched.remove(job);
+        return true;
+    }
+
+    bool setPriority(const string& id, int prio) {
+        PrintJob* job = sched.find(id);
+        if (!job || prio < 1 || prio > 5) return false;
+        job->priority = prio;
+        sched.update(job);
+        return true;
+    }
+
+    bool setDelayed(const string& id, bool delayed, string reason = "") {
+        PrintJob* job = sched.find(id);
+        if (!job) return false;
+        replace(reason.begin(), reason.end(), ',', ';'); // keep jobs.txt columns intact
+        job->status = delayed ? "Delayed" : "Queued";
+        job->reason = delayed ? reason : "";
+        sched.update(job);
+        return true;
+    }
+
+    // Prints every Queued job on a simulated clock without sleeping.
+    int runAll() {
+        int printed = 0;
+        fleet.drain(sched, epochMs(), [this, &printed](PrintJob* job, int p, long long startMs, long long endMs) {
+            history.record(job, p, startMs, endMs);
+            delete job;
+            printed++;
+        });
+        return printed;
+    }
+
+    // ---- Interactive screens ----
+
     void addJob() {
+        if (sched.size() >= MAX) {
+            UI::drawHeader("ADD JOB");
+            cout << "\n  " << UI::error() << "[X] Queue is full (" << MAX << " jobs)." << UI::reset() << endl;
+            UI::pause();
+            return;
+        }
+
         Menu typeMenu("SELECT DOCUMENT TYPE", { "PDF Document", "Image File", "Text File", "Other" });
         int typeChoice = typeMenu.show();
         string type = (typeChoice == 1) ? "PDF" : (typeChoice == 2) ? "IMG" : (typeChoice == 3) ? "TXT" : "DOC";
@@ -385,11 +1305,7 @@ public:
         int prio = atoi(pStr.c_str());
         if (prio < 1 || prio > 5) prio = 5;
 
-        string id = generateJobID(type);
-        PrintJob* job = new PrintJob(id, type, prio);
-        heap[size] = job;
-        map.insert(id, size);
-        siftUp(size++);
+        string id = submit(type, prio, currentUser);
 
         cout << "\n  " << UI::success() << "[OK] Job Created! ID: " << id << UI::reset() << endl;
         UI::pause();
@@ -398,19 +1314,14 @@ public:
     void cancelJob() {
         UI::drawHeader("CANCEL JOB");
         string id = UI::input("Enter Job ID to Cancel");
-        HashNode* node = map.find(id);
+        PrintJob* job = sched.find(id);
 
-        if (!node) {
+        if (!job) {
             cout << "\n  " << UI::error() << "[X] Job not found!" << UI::reset() << endl;
         }
         else {
             if (Input::confirm("Are you sure you want to delete " + id + "?")) {
-                int idx = node->heapIndex;
-                swapJobs(idx, size - 1);
-                map.remove(heap[size - 1]->jobID);
-                delete heap[size - 1];
-                size--;
-                if (idx < size) { siftUp(idx); siftDown(idx); }
+                cancel(id);
                 cout << "\n  " << UI::success() << "[OK] Job " << id << " removed." << UI::reset() << endl;
             }
         }
@@ -420,36 +1331,28 @@ public:
     void updateJob() {
         UI::drawHeader("UPDATE JOB STATUS");
         string id = UI::input("Enter Job ID");
-        HashNode* node = map.find(id);
+        PrintJob* job = sched.find(id);
 
-        if (!node) {
+        if (!job) {
             cout << "\n  " << UI::error() << "[X] Job not found!" << UI::reset() << endl;
             UI::pause();
             return;
         }
 
-        PrintJob* job = heap[node->heapIndex];
         Menu updateMenu("UPDATE OPTIONS", { "Update Priority", "Set Status (Delay/Queue)" });
         int choice = updateMenu.show();
 
         if (choice == 1) {
             string pStr = UI::input("New Priority (1-5)");
-            job->priority = stoi(pStr);
-            siftUp(node->heapIndex);
-            siftDown(node->heapIndex);
-            cout << "\n  " << UI::success() << "[OK] Priority Updated." << UI::reset() << endl;
+            int prio = isNumber(pStr, 1, 1) ? stoi(pStr) : 0;
+            if (setPriority(id, prio)) cout << "\n  " << UI::success() << "[OK] Priority Updated." << UI::reset() << endl;
+            else cout << "\n  " << UI::error() << "[X] Priority must be 1-5." << UI::reset() << endl;
         }
         else if (choice == 2) {
             Menu statusMenu("SELECT STATUS", { "Queued", "Delayed" });
             int st = statusMenu.show();
-            if (st == 2) {
-                job->status = "Delayed";
-                job->reason = UI::input("Reason for Delay");
-            }
-            else {
-                job->status = "Queued";
-                job->reason = "";
-            }
+            if (st == 2) setDelayed(id, true, UI::input("Reason for Delay"));
+            else setDelayed(id, false);
             cout << "\n  " << UI::success() << "[OK] Status Updated." << UI::reset() << endl;
         }
         UI::pause();
@@ -457,14 +1360,14 @@ public:
 
     void listJobs() {
         UI::drawHeader("CURRENT JOB QUEUE");
-        if (size == 0) {
+        if (sched.size() == 0) {
             cout << "\n  " << UI::warning() << "[ Empty Queue ]" << UI::reset() << endl;
         }
         else {
-            cout << UI::border() << "  ID        Type   Prio    Status       Timestamp" << UI::reset() << endl;
+            cout << UI::border() << "  ID        Type   Prio    Timestamp  Owner       Status" << UI::reset() << endl;
             UI::drawLine();
-            for (int i = 0; i < size; i++) {
-                heap[i]->displayRow();
+            for (PrintJob* job : sched.jobs()) {
+                job->displayRow();
             }
         }
         UI::pause();
@@ -472,53 +1375,124 @@ public:
 
     void processJobs() {
         UI::drawHeader("SIMULATING PRINTERS");
-        cout << "  Active Printers: " << UI::primary() << PRINTERS << UI::reset() << "\n\n";
+        cout << "  Online Printers: " << UI::primary() << fleet.onlineCount() << "/" << PRINTERS << UI::reset() << "\n\n";
 
-        while (size > 0) {
+        while (sched.size() > 0) {
             int active = 0;
-            for (int p = 0; p < PRINTERS && size > 0; p++) {
-                int idx = -1;
-                for (int i = 0; i < size; i++) {
-                    if (heap[i]->status == "Queued") { idx = i; break; }
+            for (int p = 0; p < PRINTERS && sched.hasReady(); p++) {
+                long long now = epochMs();
+                if (fleet.availableFrom(p, now) != now) {
+                    cout << "  Printer " << (p + 1) << " is " << UI::error() << PrinterFleet::statusName(fleet.status(p))
+                        << UI::reset() << ", skipped.\n\n";
+                    continue;
                 }
+                PrintJob* job = sched.dispatch();
 
-                if (idx == -1) break;
-
-                PrintJob* job = heap[idx];
-                cout << "  Printer " << (p + 1) << " processing: " << UI::primary() << job->jobID << UI::reset() << "\n";
+                cout << "  Printer " << (p + 1) << " processing: " << UI::primary() << job->jobID << UI::reset()
+                    << " (" << job->owner << ")\n";
+                long long startMs = epochMs();
+                int failAt = fleet.injectFault(p) ? 10 * (rand() % 10) : 101;
 
                 // Progress Bar Animation
-                for (int k = 0; k <= 100; k += 10) {
+                for (int k = 0; k <= 100 && k < failAt; k += 10) {
                     cout << "\r  ";
                     UI::drawProgressBar(k, 30);
                     cout.flush();
                     this_thread::sleep_for(chrono::milliseconds(job->timeRemaining * 10)); // Scaled down for demo
                 }
+                active++;
+
+                if (failAt <= 100) {
+                    fleet.reportFailure(p, epochMs());
+                    sched.requeue(job);
+                    cout << endl << "  " << UI::error() << "[FAIL] Printer " << (p + 1) << " faulted. "
+                        << job->jobID << " requeued." << UI::reset() << "\n\n";
+                    continue;
+                }
                 cout << endl << "  " << UI::success() << "[DONE] Printed Successfully." << UI::reset() << "\n\n";
 
-                // Remove logic
-                swapJobs(idx, size - 1);
-                map.remove(heap[size - 1]->jobID);
-                delete heap[size - 1];
-                size--;
-                if (idx < size) { siftUp(idx); siftDown(idx); }
-                active++;
+                fleet.reportSuccess(p);
+                history.record(job, p, startMs, epochMs());
+                delete job;
             }
             if (active == 0) {
-                cout << "\n  " << UI::error() << "[!] All remaining jobs are delayed. Pausing..." << UI::reset() << endl;
-                break;
+                long long retry = fleet.nextRetry();
+                if (!sched.hasReady()) {
+                    cout << "\n  " << UI::error() << "[!] All remaining jobs are delayed. Pausing..." << UI::reset() << endl;
+                    break;
+                }
+                if (retry < 0) {
+                    cout << "\n  " << UI::error() << "[!] No printers online. Pausing..." << UI::reset() << endl;
+                    break;
+                }
+                cout << "  " << UI::warning() << "Waiting for a printer to recover..." << UI::reset() << "\n\n";
+                this_thread::sleep_for(chrono::milliseconds(max(retry - epochMs(), 0LL)));
             }
         }
-        if (size == 0) cout << "\n  " << UI::success() << "[OK] All jobs completed." << UI::reset() << endl;
+        if (sched.size() == 0) cout << "\n  " << UI::success() << "[OK] All jobs completed." << UI::reset() << endl;
+        UI::pause();
+    }
+
+    void historyReport() {
+        UI::drawHeader("JOB HISTORY");
+        auto t0 = chrono::steady_clock::now();
+        history.load();
+        long long now = epochMs();
+        long long dayAgo = now - 24 * HOUR_MS;
+
+        cout << "  " << UI::info() << "Completed jobs on record: " << UI::reset() << history.size() << "\n\n";
+
+        cout << UI::border() << "  Hour (UTC)   PDF    IMG    TXT    DOC" << UI::reset() << endl;
+        UI::drawLine(40);
+        for (const auto& hc : history.throughputByHour(dayAgo, now + 1)) {
+            cout << "  " << UI::text() << setw(2) << setfill('0') << right << (hc.hour % 24) << ":00" << setfill(' ') << "      ";
+            for (int t = 0; t < JOB_TYPES; t++) cout << left << setw(7) << hc.count[t];
+            cout << UI::reset() << endl;
+        }
+
+        cout << "\n" << UI::border() << "  Prio   Jobs      p50 wait    p95 wait" << UI::reset() << endl;
+        UI::drawLine(40);
+        for (int prio = 1; prio <= 5; prio++) {
+            uint64_t n = 0;
+            uint32_t p95 = history.waitPercentile(prio, 0.95, 0, now + HOUR_MS, &n);
+            uint32_t p50 = history.waitPercentile(prio, 0.50, 0, now + HOUR_MS);
+            cout << "  " << UI::text() << left << setw(7) << prio << setw(10) << n
+                << setw(12) << (to_string(p50) + " ms") << (to_string(p95) + " ms") << UI::reset() << endl;
+        }
+
+        cout << "\n" << UI::border() << "  Printer   Busy (s)" << UI::reset() << endl;
+        UI::drawLine(40);
+        for (int p = 0; p < PRINTERS; p++)
+            cout << "  " << UI::text() << left << setw(10) << (p + 1)
+                << history.printerBusyMs(p, 0, now + HOUR_MS) / 1000.0 << UI::reset() << endl;
+
+        cout << "\n" << UI::border() << "  User (last 24h)     Jobs" << UI::reset() << endl;
+        UI::drawLine(40);
+        auto byUser = history.jobsByUser(dayAgo, now + 1);
+        for (size_t i = 0; i < byUser.size() && i < 5; i++)
+            cout << "  " << UI::text() << left << setw(20) << byUser[i].first << byUser[i].second << UI::reset() << endl;
+
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        cout << "\n  " << UI::info() << "Report built in " << fixed << setprecision(1) << ms << " ms" << UI::reset() << endl;
+        cout.unsetf(ios::fixed);
         UI::pause();
     }
 
     // Persistence
+    static bool isNumber(const string& s, size_t minLen, size_t maxLen) {
+        if (s.size() < minLen || s.size() > maxLen) return false;
+        for (char c : s) if (!isdigit((unsigned char)c)) return false;
+        return true;
+    }
+
     void saveToFile() {
         ofstream fout(JOB_FILE);
-        for (int i = 0; i < size; i++)
-            fout << heap[i]->jobID << "," << heap[i]->type << "," << heap[i]->priority
-            << "," << heap[i]->status << "," << heap[i]->reason << endl;
+        // Submission order, so equal-priority jobs reload in the same order.
+        vector<PrintJob*> all = sched.jobs();
+        sort(all.begin(), all.end(), [](const PrintJob* a, const PrintJob* b) { return a->seq < b->seq; });
+        for (PrintJob* job : all)
+            fout << job->jobID << "," << job->type << "," << job->priority
+            << "," << job->status << "," << job->reason << "," << job->owner << "," << job->submittedMs << endl;
         fout.close();
     }
 
@@ -528,27 +1502,276 @@ public:
         string line;
         int maxID = 0;
         while (getline(fin, line)) {
-            if (line.empty()) continue;
-            string t[5]; int c = 0; size_t pos = 0, prev = 0;
-            while ((pos = line.find(',', prev)) != string::npos && c < 4) {
-                t[c++] = line.substr(prev, pos - prev);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            vector<string> t;
+            size_t pos = 0, prev = 0;
+            while ((pos = line.find(',', prev)) != string::npos) {
+                t.push_back(line.substr(prev, pos - prev));
                 prev = pos + 1;
             }
-            t[c] = line.substr(prev);
-            PrintJob* job = new PrintJob(t[0], t[1], stoi(t[2]));
-            job->status = t[3]; job->reason = t[4];
-            heap[size] = job; map.insert(job->jobID, size); siftUp(size++);
+            t.push_back(line.substr(prev));
+            if (t.size() < 5 || t[0].empty()) continue; // malformed, skip
+            // A bad priority must not lose the job; treat it as addJob does.
+            int prio = atoi(t[2].c_str());
+            if (prio < 1 || prio > 5) prio = 5;
+
+            // Current rows end in owner and an epoch-ms submit time. Baseline
+            // rows stop at the reason, which may itself contain commas.
+            string owner = "system";
+            long long submitted = -1;
+            size_t reasonEnd = t.size();
+            if (t.size() >= 7 && isNumber(t.back(), 12, 18) && !t[t.size() - 2].empty()) {
+                submitted = stoll(t.back());
+                owner = t[t.size() - 2];
+                reasonEnd = t.size() - 2;
+            }
+            string reason = t[4];
+            for (size_t i = 5; i < reasonEnd; i++) reason += ";" + t[i];
+
+            PrintJob* job = new PrintJob(t[0], t[1], prio, owner);
+            job->status = t[3]; job->reason = reason;
+            if (submitted >= 0) job->submittedMs = submitted;
+            sched.submit(job);
 
             // Extract numeric part of ID for nextID logic
             string n = "";
             for (char ch : t[0]) if (isdigit(ch)) n += ch;
-            if (!n.empty() && stoi(n) > maxID) maxID = stoi(n);
+            if (isNumber(n, 1, 9) && stoi(n) > maxID) maxID = stoi(n);
         }
         nextID = maxID + 1;
         fin.close();
     }
 };
 
+// ==========================================
+//               USER STORE
+// ==========================================
+
+// Plain SHA-256 (FIPS 180-4); only used for password hashing below.
+class Sha256 {
+private:
+    static uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    static void block(uint32_t h[8], const unsigned char* p) {
+        static const uint32_t k[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+        };
+        uint32_t w[64];
+        for (int i = 0; i < 16; i++)
+            w[i] = (uint32_t)p[i * 4] << 24 | (uint32_t)p[i * 4 + 1] << 16 | (uint32_t)p[i * 4 + 2] << 8 | p[i * 4 + 3];
+        for (int i = 16; i < 64; i++) {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], hh = h[7];
+        for (int i = 0; i < 64; i++) {
+            uint32_t t1 = hh + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+            uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            hh = g; g = f; f = e; e = d + t1; d = c; c = b; b = a; a = t1 + t2;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e; h[5] += f; h[6] += g; h[7] += hh;
+    }
+
+public:
+    // Raw 32-byte digest.
+    static string digest(const string& data) {
+        uint32_t h[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+        const unsigned char* p = (const unsigned char*)data.data();
+        size_t full = data.size() / 64 * 64;
+        for (size_t i = 0; i < full; i += 64) block(h, p + i);
+
+        // Pad the tail on the stack instead of copying the whole message.
+        unsigned char tail[128] = { 0 };
+        size_t rest = data.size() - full;
+        memcpy(tail, p + full, rest);
+        tail[rest] = 0x80;
+        size_t len = rest < 56 ? 64 : 128;
+        uint64_t bits = (uint64_t)data.size() * 8;
+        for (int i = 0; i < 8; i++) tail[len - 1 - i] = (unsigned char)(bits >> (i * 8));
+        block(h, tail);
+        if (len == 128) block(h, tail + 64);
+        string out(32, 0);
+        for (int i = 0; i < 32; i++) out[i] = (char)(h[i / 4] >> (24 - 8 * (i % 4)));
+        return out;
+    }
+
+    static string toHex(const string& raw) {
+        static const char* digits = "0123456789abcdef";
+        string out;
+        for (unsigned char c : raw) { out += digits[c >> 4]; out += digits[c & 15]; }
+        return out;
+    }
+};
+
+struct UserRecord {
+    string salt;    // hex
+    string hash;    // hex, PASSWORD_ROUNDS of SHA-256 over salt + password
+};
+
+// All accounts are loaded once into a hash index. users.txt is a snapshot
+// ("user,salt,hash" per line) and new accounts are appended to users.journal,
+// which is replayed on load and folded back into the snapshot once it grows
+// past JOURNAL_COMPACT_AT records. Legacy plaintext "user,password" lines are
+// hashed on load and the snapshot rewritten without them.
+class UserStore {
+private:
+    unordered_map<string, UserRecord> users;
+    mutable shared_mutex lock;
+    ofstream journal;
+    string snapshotFile, journalFile;
+    int journalRecords;
+
+    static string newSalt() {
+        static random_device rd;
+        string raw(16, 0);
+        for (char& c : raw) c = (char)(rd() & 0xFF);
+        return Sha256::toHex(raw);
+    }
+
+    static bool sameDigest(const string& a, const string& b) {
+        if (a.size() != b.size()) return false;
+        unsigned char diff = 0;
+        for (size_t i = 0; i < a.size(); i++) diff |= a[i] ^ b[i];
+        return diff == 0;
+    }
+
+    static bool isHex(const string& s, size_t len) {
+        if (s.size() != len) return false;
+        for (char c : s) if (!isxdigit((unsigned char)c)) return false;
+        return true;
+    }
+
+    // Returns false when the snapshot held plaintext entries. A line is only
+    // taken as hashed when it is exactly "user,<32 hex salt>,<64 hex hash>";
+    // anything else is a legacy "user,password" line, and the password may
+    // itself contain commas.
+    bool loadSnapshot() {
+        ifstream fin(snapshotFile);
+        string line;
+        bool clean = true;
+        while (getline(fin, line)) {
+            size_t a = line.find(',');
+            if (line.empty() || a == string::npos) continue;
+            size_t b = line.find(',', a + 1);
+            string u = line.substr(0, a);
+            if (b != string::npos && isHex(line.substr(a + 1, b - a - 1), 32) && isHex(line.substr(b + 1), 64)) {
+                users[u] = { line.substr(a + 1, b - a - 1), line.substr(b + 1) };
+            }
+            else {
+                string salt = newSalt();
+                users[u] = { salt, hashPassword(salt, line.substr(a + 1)) };
+                clean = false;
+            }
+        }
+        return clean;
+    }
+
+    // Returns false when the journal ends in a torn record (a bad line, or a
+    // last line with no newline), which must be cut off before appending.
+    bool replayJournal() {
+        ifstream fin(journalFile);
+        string line;
+        bool clean = true;
+        while (getline(fin, line)) {
+            // "+,user,salt,hash"; a torn line fails the length check and is dropped.
+            if (fin.eof()) clean = false;
+            size_t a = line.find(',', 2);
+            size_t b = a == string::npos ? a : line.find(',', a + 1);
+            if (line.compare(0, 2, "+,") != 0 || b == string::npos || line.size() - b - 1 != 64) { clean = false; continue; }
+            users[line.substr(2, a - 2)] = { line.substr(a + 1, b - a - 1), line.substr(b + 1) };
+            journalRecords++;
+        }
+        return clean;
+    }
+
+    // The journal is only truncated once the new snapshot has been written
+    // in full and swapped in; on any failure both files stay as they were.
+    bool compact() {
+        string tmp = snapshotFile + ".tmp";
+        ofstream fout(tmp, ios::trunc);
+        for (auto& entry : users)
+            fout << entry.first << "," << entry.second.salt << "," << entry.second.hash << "\n";
+        fout.close();
+        if (fout.fail() || !replaceFile(tmp, snapshotFile)) {
+            std::remove(tmp.c_str());
+            if (!journal.is_open()) journal.open(journalFile, ios::app);
+            return false;
+        }
+        if (journal.is_open()) journal.close();
+        journal.open(journalFile, ios::trunc);
+        journalRecords = 0;
+        return true;
+    }
+
+public:
+    static string hashPassword(const string& salt, const string& password) {
+        string h = Sha256::digest(salt + password);
+        string buf = h + salt;
+        for (int i = 1; i < PASSWORD_ROUNDS; i++) {
+            h = Sha256::digest(buf);
+            buf.replace(0, h.size(), h);
+        }
+        return Sha256::toHex(h);
+    }
+
+    UserStore(string snapshot = USER_FILE, string journalPath = USER_JOURNAL) {
+        snapshotFile = snapshot;
+        journalFile = journalPath;
+        journalRecords = 0;
+        bool clean = loadSnapshot();
+        bool journalClean = replayJournal();
+        if (clean && journalClean && journalRecords < JOURNAL_COMPACT_AT) journal.open(journalFile, ios::app);
+        else if (!compact() && !journalClean) {
+            // Could not compact the torn tail away; end it so the next record
+            // starts on a line of its own.
+            journal << "\n";
+            journal.flush();
+        }
+    }
+
+    int count() const {
+        shared_lock<shared_mutex> guard(lock);
+        return users.size();
+    }
+
+    bool exists(const string& user) const {
+        shared_lock<shared_mutex> guard(lock);
+        return users.count(user) > 0;
+    }
+
+    // Hashing happens outside the lock so concurrent logins don't serialise.
+    bool verify(const string& user, const string& password) const {
+        UserRecord rec;
+        {
+            shared_lock<shared_mutex> guard(lock);
+            auto it = users.find(user);
+            if (it == users.end()) return false;
+            rec = it->second;
+        }
+        return sameDigest(hashPassword(rec.salt, password), rec.hash);
+    }
+
+    bool add(const string& user, const string& password) {
+        if (user.empty() || user.find(',') != string::npos) return false;
+        string salt = newSalt();
+        UserRecord rec = { salt, hashPassword(salt, password) };
+        unique_lock<shared_mutex> guard(lock);
+        if (!users.emplace(user, rec).second) return false;
+        journal << "+," << user << "," << rec.salt << "," << rec.hash << "\n";
+        journal.flush();
+        if (++journalRecords >= JOURNAL_COMPACT_AT) compact();
+        return true;
+    }
+};
+
 // ==========================================
 //           DASHBOARD & AUTH
 // ==========================================
@@ -566,7 +1789,7 @@ public:
         cout << "  " << UI::primary() << "SYSTEM STATUS" << UI::reset()
             << " | Jobs: " << UI::info() << app.getJobCount() << UI::reset()
             << " | Delayed: " << UI::error() << app.getDelayedCount() << UI::reset()
-            << " | Printers: " << UI::success() << PRINTERS << " Active" << UI::reset() << endl;
+            << " | Printers: " << UI::success() << app.getFleet().onlineCount() << "/" << PRINTERS << " Online" << UI::reset() << endl;
 
         cout << UI::border();
         for (int i = 0; i < UI::getWidth(); i++) cout << "=";
@@ -574,32 +1797,34 @@ public:
     }
 };
 
-bool signup() {
+bool signup(UserStore& store) {
     UI::drawHeader("NEW USER REGISTRATION");
     string u = UI::input("Create Username");
 
-    ifstream fin(USER_FILE);
-    string line;
-    while (getline(fin, line)) {
-        if (line.substr(0, line.find(',')) == u) {
-            cout << "\n  " << UI::error() << "[X] User already exists!" << UI::reset() << endl;
-            UI::pause();
-            return false;
-        }
+    if (store.exists(u)) {
+        cout << "\n  " << UI::error() << "[X] User already exists!" << UI::reset() << endl;
+        UI::pause();
+        return false;
+    }
+    if (u.empty() || u.find(',') != string::npos) {
+        cout << "\n  " << UI::error() << "[X] Username must be non-empty and contain no commas." << UI::reset() << endl;
+        UI::pause();
+        return false;
     }
-    fin.close();
 
     string p = UI::input("Create Password");
-    ofstream fout(USER_FILE, ios::app);
-    fout << u << "," << p << endl;
-    fout.close();
+    if (!store.add(u, p)) {
+        cout << "\n  " << UI::error() << "[X] User already exists!" << UI::reset() << endl;
+        UI::pause();
+        return false;
+    }
 
     cout << "\n  " << UI::success() << "[OK] Registration Successful!" << UI::reset() << endl;
     UI::pause();
     return true;
 }
 
-bool login() {
+bool login(UserStore& store, string& user) {
     int attempts = 0;
     while (attempts < 3) {
         UI::drawHeader("USER LOGIN");
@@ -608,18 +1833,8 @@ bool login() {
         string u = UI::input("Username");
         string p = UI::input("Password");
 
-        ifstream fin(USER_FILE);
-        string line;
-        bool found = false;
-        while (getline(fin, line)) {
-            size_t pos = line.find(',');
-            if (line.substr(0, pos) == u && line.substr(pos + 1) == p) {
-                found = true;
-                break;
-            }
-        }
-
-        if (found) {
+        if (store.verify(u, p)) {
+            user = u;
             cout << "\n  " << UI::success() << "[OK] Access Granted." << UI::reset() << endl;
             this_thread::sleep_for(chrono::milliseconds(800));
             return true;
@@ -633,10 +1848,562 @@ bool login() {
     return false;
 }
 
+// ==========================================
+//               BENCHMARKS
+// ==========================================
+
+class Benchmark {
+private:
+    struct Arrival {
+        int tick;
+        PrintJob* job;
+    };
+
+    struct Result {
+        double lightAvg, lightMax, heavyDone, nsPerDispatch;
+    };
+
+    // Discrete-time run of PRINTERS printers draining the arrival list.
+    // With fair=false every job is filed under one owner, which reproduces
+    // the old single priority heap.
+    static Result simulate(bool fair, int heavyJobs, int lightUsers, int interval) {
+        srand(42);
+        vector<Arrival> arrivals;
+        unordered_map<const PrintJob*, int> submitted;
+        for (int i = 0; i < heavyJobs; i++)
+            arrivals.push_back({ 0, new PrintJob("H" + to_string(i), "PDF", 1, fair ? "heavy" : "all") });
+        int horizon = heavyJobs * 10 / PRINTERS;
+        for (int t = 0; t < horizon; t += interval)
+            for (int u = 0; u < lightUsers; u++)
+                arrivals.push_back({ t, new PrintJob("L" + to_string(u) + "-" + to_string(t), "TXT", 3,
+                    fair ? "light" + to_string(u) : "all") });
+        stable_sort(arrivals.begin(), arrivals.end(), [](const Arrival& a, const Arrival& b) { return a.tick < b.tick; });
+
+        FairScheduler sched;
+        vector<int> freeAt(PRINTERS, 0);
+        size_t next = 0;
+        long long lightWaitSum = 0, dispatches = 0, dispatchNs = 0;
+        int lightCount = 0, lightMax = 0, heavyDone = 0;
+
+        while (next < arrivals.size() || sched.size() > 0) {
+            int p = min_element(freeAt.begin(), freeAt.end()) - freeAt.begin();
+            int now = freeAt[p];
+            if (sched.size() == 0 && arrivals[next].tick > now) now = arrivals[next].tick;
+            while (next < arrivals.size() && arrivals[next].tick <= now) {
+                submitted[arrivals[next].job] = arrivals[next].tick;
+                sched.submit(arrivals[next++].job);
+            }
+
+            auto t0 = chrono::steady_clock::now();
+            PrintJob* job = sched.dispatch();
+            dispatchNs += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count();
+            dispatches++;
+
+            int wait = now - submitted[job];
+            freeAt[p] = now + job->timeRemaining;
+            if (job->jobID[0] == 'L') {
+                lightWaitSum += wait;
+                lightCount++;
+                lightMax = max(lightMax, wait);
+            }
+            else heavyDone = max(heavyDone, freeAt[p]);
+            delete job;
+        }
+        return { (double)lightWaitSum / max(lightCount, 1), (double)lightMax, (double)heavyDone,
+            (double)dispatchNs / max(dispatches, 1LL) };
+    }
+
+public:
+    static void fairShare() {
+        const int heavyJobs = 20000, lightUsers = 4, interval = 40;
+        cout << "Fair-share benchmark: 1 heavy user (" << heavyJobs << " x P1 PDF at t=0), "
+            << lightUsers << " light users (1 x P3 TXT every " << interval << " ticks), "
+            << PRINTERS << " printers\n\n";
+        cout << left << setw(16) << "mode" << right << setw(14) << "light avg" << setw(14) << "light max"
+            << setw(14) << "heavy done" << setw(16) << "ns/dispatch" << "\n";
+
+        const char* names[] = { "priority-only", "fair-share" };
+        for (int fair = 0; fair <= 1; fair++) {
+            Result r = simulate(fair == 1, heavyJobs, lightUsers, interval);
+            cout << left << setw(16) << names[fair] << right << fixed << setprecision(1)
+                << setw(14) << r.lightAvg << setw(14) << r.lightMax
+                << setw(14) << r.heavyDone << setw(16) << r.nsPerDispatch << "\n";
+        }
+        cout << "\n(wait times in simulated ticks)\n";
+    }
+
+    static void authentication() {
+        const int accounts = 50000, loginsPerThread = 500, legacyLogins = 200;
+        const string snapshot = "bench_users.txt", journalPath = "bench_users.journal", legacy = "bench_legacy.txt";
+
+        // Every account shares one salt so the fixture builds without 50k hash runs.
+        const string salt = "00112233445566778899aabbccddeeff";
+        const string hash = UserStore::hashPassword(salt, "secret");
+        {
+            ofstream snap(snapshot, ios::trunc), plain(legacy, ios::trunc);
+            for (int i = 0; i < accounts; i++) {
+                snap << "user" << i << "," << salt << "," << hash << "\n";
+                plain << "user" << i << ",secret\n";
+            }
+        }
+
+        cout << "Authentication benchmark: " << accounts << " accounts, "
+            << PASSWORD_ROUNDS << " SHA-256 rounds per password\n\n";
+
+        auto t0 = chrono::steady_clock::now();
+        {
+            UserStore store(snapshot, journalPath);
+            double loadMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+            cout << "  index load:        " << fixed << setprecision(1) << loadMs << " ms\n";
+
+            t0 = chrono::steady_clock::now();
+            int hits = 0;
+            for (int i = 0; i < accounts; i++) hits += store.exists("user" + to_string(i));
+            double lookupNs = chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count() / accounts;
+            cout << "  index lookup:      " << lookupNs << " ns (" << hits << " hits)\n";
+
+            t0 = chrono::steady_clock::now();
+            int legacyOk = 0;
+            for (int i = 0; i < legacyLogins; i++) {
+                string u = "user" + to_string((i * 7919) % accounts);
+                ifstream fin(legacy);
+                string line;
+                while (getline(fin, line)) {
+                    size_t pos = line.find(',');
+                    if (line.substr(0, pos) == u && line.substr(pos + 1) == "secret") { legacyOk++; break; }
+                }
+            }
+            double legacySec = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+            cout << "  legacy file scan:  " << setprecision(0) << legacyLogins / legacySec << " logins/s (1 thread)\n";
+
+            for (int threads = 1; threads <= 8; threads *= 2) {
+                vector<thread> pool;
+                vector<int> ok(threads, 0);
+                t0 = chrono::steady_clock::now();
+                for (int t = 0; t < threads; t++) {
+                    pool.emplace_back([&store, &ok, t, accounts, loginsPerThread]() {
+                        for (int i = 0; i < loginsPerThread; i++)
+                            ok[t] += store.verify("user" + to_string((i * 104729 + t) % accounts), "secret");
+                    });
+                }
+                for (thread& th : pool) th.join();
+                double sec = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+                int total = 0;
+                for (int n : ok) total += n;
+                cout << "  indexed + hashed:  " << setprecision(0) << threads * loginsPerThread / sec
+                    << " logins/s (" << threads << " threads, " << total << " ok)\n";
+            }
+        }
+        std::remove(snapshot.c_str());
+        std::remove(journalPath.c_str());
+        std::remove(legacy.c_str());
+    }
+
+    static void history(long long rows) {
+        const int hours = 2000, users = 1000;
+        const string dir = "bench_history";
+        error_code ec;
+        filesystem::remove_all(dir, ec);
+        HistoryStore store(dir);
+        vector<string> names;
+        for (int u = 0; u < users; u++) names.push_back("user" + to_string(u));
+
+        cout << "History benchmark: " << rows << " completed jobs over " << hours << " hours\n\n";
+
+        uint64_t x = 88172645463325252ULL;  // xorshift64
+        auto next = [&x]() { x ^= x << 13; x ^= x >> 7; x ^= x << 17; return x; };
+        long long base = 1700000000000LL;
+        long long step = max(hours * HOUR_MS / max(rows, 1LL), 1LL);
+
+        auto t0 = chrono::steady_clock::now();
+        for (long long i = 0; i < rows; i++) {
+            uint64_t r = next();
+            int prio = 1 + (int)(r % 5);
+            store.append(base + i * step, (uint32_t)((r >> 8) % (prio * 60000)), 2000 + (uint32_t)((r >> 24) % 13000),
+                (int)((r >> 40) % JOB_TYPES), prio, (int)((r >> 44) % PRINTERS), names[(r >> 48) % users]);
+        }
+        double appendSec = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        cout << "  append:                 " << fixed << setprecision(1) << appendSec * 1e9 / max(rows, 1LL) << " ns/row\n";
+
+        long long from = base, to = base + hours * HOUR_MS + HOUR_MS;
+        auto timeIt = [](const char* label, function<void()> fn) {
+            auto s = chrono::steady_clock::now();
+            fn();
+            cout << "  " << left << setw(24) << label << right << setprecision(2)
+                << chrono::duration<double, milli>(chrono::steady_clock::now() - s).count() << " ms\n";
+        };
+
+        timeIt("flush to disk:", [&]() { store.flush(); });
+
+        // Queries run against a fresh store, as the first report after a
+        // restart would, so the load time is part of the picture.
+        uint64_t sink = 0;
+        {
+            HistoryStore cold(dir);
+            timeIt("cold load (rollups):", [&]() { cold.load(); });
+            timeIt("throughput/type/hour:", [&]() { sink += cold.throughputByHour(from, to).size(); });
+            timeIt("p95 wait x 5 prios:", [&]() { for (int p = 1; p <= 5; p++) sink += cold.waitPercentile(p, 0.95, from, to); });
+            timeIt("avg print x 4 types:", [&]() { for (int t = 0; t < JOB_TYPES; t++) sink += (uint64_t)cold.avgPrintMs(t, from, to); });
+            timeIt("printer busy x 5:", [&]() { for (int p = 0; p < PRINTERS; p++) sink += cold.printerBusyMs(p, from, to); });
+            timeIt("jobs by user, 24h:", [&]() { sink += cold.jobsByUser(to - 25 * HOUR_MS + HOUR_MS / 2, to).size(); });
+            sink += cold.size() == rows;
+            timeIt("append 1 + flush:", [&]() { cold.append(to - HOUR_MS, 1000, 5000, 0, 3, 0, names[0]); cold.flush(); });
+        }
+        cout << "\n  (checksum " << sink << ")\n";
+        filesystem::remove_all(dir, ec);
+    }
+
+    // Fault-injection checks plus fleet throughput under a partial outage.
+    // Returns non-zero if any check fails.
+    static int faults() {
+        int failed = 0;
+        auto check = [&failed](const char* name, bool ok) {
+            cout << "  " << (ok ? "[PASS] " : "[FAIL] ") << name << "\n";
+            if (!ok) failed++;
+        };
+
+        cout << "Fault injection checks\n\n";
+        {
+            // A requeued job goes back ahead of later jobs of the same priority.
+            FairScheduler sched;
+            PrintJob* a = new PrintJob("A", "TXT", 2, "u");
+            PrintJob* b = new PrintJob("B", "TXT", 2, "u");
+            PrintJob* c = new PrintJob("C", "TXT", 1, "v");
+            sched.submit(a); sched.submit(b); sched.submit(c);
+            PrintJob* first = sched.dispatch();
+            PrintJob* second = sched.dispatch();
+            sched.requeue(second);
+            PrintJob* again = sched.dispatch();
+            check("requeued job is dispatched again before its successors", again == second);
+            check("requeued job keeps its priority", again->priority == 2);
+            delete first;
+            delete again;
+        }
+        {
+            PrinterFleet fleet(2);
+            fleet.reportFailure(0, 1000);
+            check("failed printer goes to Error", fleet.status(0) == PrinterStatus::Error);
+            check("breaker holds printer out during cooldown", fleet.availableFrom(0, 1000) == 1000 + BREAKER_COOLDOWN_MS);
+            fleet.reportFailure(0, 1000 + BREAKER_COOLDOWN_MS);
+            check("cooldown doubles on repeated failure", fleet.availableFrom(0, 0) == 1000 + 3LL * BREAKER_COOLDOWN_MS);
+            fleet.reportSuccess(0);
+            check("successful health check closes breaker", fleet.status(0) == PrinterStatus::Online && fleet.availableFrom(0, 5) == 5);
+            fleet.setStatus(1, PrinterStatus::Maintenance);
+            check("maintenance printer takes no jobs", fleet.availableFrom(1, 0) == -1);
+        }
+        {
+            // Printer 0 is cut off 100 ms into the job while printer 1 has been
+            // idle since 0; the retry on printer 1 must still start at 100.
+            FairScheduler sched;
+            sched.submit(new PrintJob("R", "PDF", 1, "u"));
+            PrinterFleet fleet(2);
+            fleet.scheduleOutage(0, 100, LLONG_MAX);
+            long long retryStart = -1;
+            fleet.drain(sched, 0, [&retryStart](PrintJob* job, int, long long start, long long) {
+                retryStart = start;
+                delete job;
+            });
+            check("retry starts no earlier than the interruption", retryStart == 100);
+        }
+
+        const int jobs = 20000;
+        auto runScenario = [&](const char* name, bool outage, double& efficiency, bool& startsInOrder) {
+            srand(7);
+            FairScheduler sched;
+            unordered_map<string, int> printedCount;
+            unordered_map<string, int> priority;
+            long long work = 0;
+            for (int i = 0; i < jobs; i++) {
+                PrintJob* job = new PrintJob("J" + to_string(i), i % 3 == 0 ? "IMG" : "PDF", 1 + i % 5, "user" + to_string(i % 8));
+                priority[job->jobID] = job->priority;
+                work += job->timeRemaining * 110LL;
+                sched.submit(job);
+            }
+
+            PrinterFleet fleet;
+            long long healthyMakespan = work / PRINTERS;
+            if (outage) {
+                fleet.setFaultRate(0, 0.3);                                         // flaky
+                fleet.scheduleOutage(1, healthyMakespan / 4, healthyMakespan * 3 / 5);  // drops out mid-run, returns
+                fleet.scheduleOutage(2, healthyMakespan / 2, LLONG_MAX);                // dies for good
+            }
+
+            bool priorityKept = true;
+            long long makespan = fleet.drain(sched, 0, [&](PrintJob* job, int, long long start, long long) {
+                printedCount[job->jobID]++;
+                if (priority[job->jobID] != job->priority) priorityKept = false;
+                if (start < job->readyAt) startsInOrder = false;
+                delete job;
+            });
+
+            // Lower bound: the time at which the fleet's usable capacity covers the work.
+            long long capacity[PRINTERS];
+            long long lo = 0, hi = work;
+            while (lo < hi) {
+                long long mid = (lo + hi) / 2, total = 0;
+                for (int p = 0; p < PRINTERS; p++) {
+                    capacity[p] = mid;
+                    for (const auto& w : fleet.unit(p).outages)
+                        if (w.first < mid) capacity[p] -= min(mid, w.second) - w.first;
+                    total += capacity[p];
+                }
+                if (total >= work) hi = mid; else lo = mid + 1;
+            }
+
+            int lost = 0, duplicated = 0;
+            for (auto& entry : priority) {
+                int n = printedCount.count(entry.first) ? printedCount[entry.first] : 0;
+                if (n == 0) lost++;
+                if (n > 1) duplicated++;
+            }
+            long long interrupted = 0;
+            for (int p = 0; p < PRINTERS; p++) interrupted += fleet.unit(p).interrupted;
+
+            efficiency = 100.0 * lo / max(makespan, 1LL);
+            cout << "  " << left << setw(16) << name << right << setw(12) << makespan / 1000 << setw(12) << lo / 1000
+                << setw(11) << fixed << setprecision(1) << efficiency << "%" << setw(13) << interrupted
+                << setw(7) << lost << setw(7) << duplicated << "\n";
+            return lost == 0 && duplicated == 0 && priorityKept;
+        };
+
+        cout << "\nThroughput under failure: " << jobs << " jobs, " << PRINTERS << " printers\n"
+            << "  (outage: printer 1 fails 30% of jobs, printer 2 offline for part of the run, printer 3 dies halfway)\n\n";
+        cout << "  " << left << setw(16) << "scenario" << right << setw(12) << "makespan s" << setw(12) << "bound s"
+            << setw(12) << "efficiency" << setw(13) << "interrupted" << setw(7) << "lost" << setw(7) << "dup" << "\n";
+        double healthy = 0, degraded = 0;
+        bool inOrder = true;
+        bool okHealthy = runScenario("healthy", false, healthy, inOrder);
+        bool okOutage = runScenario("partial outage", true, degraded, inOrder);
+        cout << "\n";
+        check("healthy run prints every job exactly once", okHealthy);
+        check("outage run prints every job exactly once with priorities kept", okOutage);
+        check("no job restarts before its last interruption", inOrder);
+
+        cout << "\n  " << (failed ? "FAILED: " : "OK: ") << failed << " check(s) failed\n";
+        return failed ? 1 : 0;
+    }
+};
+
+// ==========================================
+//               BATCH MODE
+// ==========================================
+
+// Scripted front end: one command per line, no UI and no animation. Every
+// command works on the in-memory queue; jobs.txt and the history directory
+// are written once, when the MinHeap goes out of scope at the end of the run.
+class Batch {
+private:
+    static string jobType(string type) {
+        for (char& c : type) c = toupper(c);
+        if (type == "PDF" || type == "IMG" || type == "TXT") return type;
+        return "DOC";
+    }
+
+    // Signup's rule (non-empty, no commas, which would break jobs.txt),
+    // applied after trimming blanks and the '\r' left by CRLF files.
+    static bool ownerName(string& name) {
+        size_t a = name.find_first_not_of(" \t\r\n"), b = name.find_last_not_of(" \t\r\n");
+        name = a == string::npos ? "" : name.substr(a, b - a + 1);
+        return !name.empty() && name.find(',') == string::npos;
+    }
+
+    // A single digit 1-5; anything else is an error in scripted use.
+    static bool priority(string s, int& prio) {
+        if (!s.empty() && s.back() == '\r') s.pop_back();
+        if (s.size() != 1 || s[0] < '1' || s[0] > '5') return false;
+        prio = s[0] - '0';
+        return true;
+    }
+
+    // "" when id exists and belongs to user, else the error to report.
+    static string owned(MinHeap& app, const string& id, const string& user) {
+        const PrintJob* job = app.getJob(id);
+        if (!job) return "job not found: " + id;
+        if (job->owner != user) return "not your job: " + id;
+        return "";
+    }
+
+    static void usage() {
+        cerr << "usage: task2 [--user NAME] <command> [args]\n"
+            << "       task2 [--user NAME] --batch < commands.txt\n"
+            << "       task2 --bench fairness|auth|history|faults [rows]\n\n"
+            << "--user signs in with the password in $" PASSWORD_ENV ". Jobs belong to the\n"
+            << "signed-in user ('system' without --user); an OWNER, if given, must be that\n"
+            << "user, and only a job's owner may cancel, prio, delay or resume it.\n\n"
+            << "commands:\n"
+            << "  submit TYPE PRIORITY [OWNER]   queue a job, prints its ID\n"
+            << "  cancel ID                      remove a job\n"
+            << "  prio ID PRIORITY               change a job's priority\n"
+            << "  delay ID [REASON...]           hold a job\n"
+            << "  resume ID                      release a held job\n"
+            << "  list                           ID TYPE PRIORITY STATUS OWNER per line\n"
+            << "  run                            print every queued job (simulated, no waiting)\n"
+            << "  printer N STATE                set printer N (1-" << PRINTERS << ") online|offline|maintenance|error\n"
+            << "  fault N RATE                   make printer N fail RATE (0-0.95) of its jobs\n"
+            << "  printers                       N STATUS PRINTED INTERRUPTED per line\n"
+            << "  import FILE                    submit TYPE,PRIORITY[,OWNER] lines from FILE\n";
+    }
+
+public:
+    // Returns an error message, or "" on success. user is the signed-in
+    // caller: every job it queues is its own, so the fair-share scheduler
+    // can't be dodged by spreading jobs over made-up owners.
+    static string execute(MinHeap& app, const vector<string>& w, const string& user, ostream& out) {
+        const string& cmd = w[0];
+        string err;
+        if (cmd == "submit" && (w.size() == 3 || w.size() == 4)) {
+            int prio;
+            if (!priority(w[2], prio)) return "priority must be 1-5: " + w[2];
+            string owner = w.size() == 4 ? w[3] : user;
+            if (!ownerName(owner) || owner != user) return "OWNER must be the signed-in user (" + user + "): " + owner;
+            string id = app.submit(jobType(w[1]), prio, owner);
+            if (id.empty()) return "queue is full";
+            out << id << '\n';
+        }
+        else if (cmd == "cancel" && w.size() == 2) {
+            if (!(err = owned(app, w[1], user)).empty()) return err;
+            app.cancel(w[1]);
+        }
+        else if (cmd == "prio" && w.size() == 3) {
+            int prio;
+            if (!priority(w[2], prio)) return "priority must be 1-5: " + w[2];
+            if (!(err = owned(app, w[1], user)).empty()) return err;
+            app.setPriority(w[1], prio);
+        }
+        else if (cmd == "delay" && w.size() >= 2) {
+            if (!(err = owned(app, w[1], user)).empty()) return err;
+            string reason;
+            for (size_t i = 2; i < w.size(); i++) reason += (i > 2 ? " " : "") + w[i];
+            app.setDelayed(w[1], true, reason.empty() ? "None" : reason);
+        }
+        else if (cmd == "resume" && w.size() == 2) {
+            if (!(err = owned(app, w[1], user)).empty()) return err;
+            app.setDelayed(w[1], false);
+        }
+        else if (cmd == "list" && w.size() == 1) {
+            for (PrintJob* job : app.getJobs())
+                out << job->jobID << ' ' << job->type << ' ' << job->priority << ' '
+                    << job->status << ' ' << job->owner << '\n';
+        }
+        else if (cmd == "run" && w.size() == 1) {
+            out << "printed " << app.runAll() << '\n';
+        }
+        else if (cmd == "printer" && w.size() == 3) {
+            int p = atoi(w[1].c_str()) - 1;
+            string st = w[2];
+            for (char& c : st) c = tolower(c);
+            if (p < 0 || p >= PRINTERS) return "no such printer: " + w[1];
+            if (st == "online") app.getFleet().setStatus(p, PrinterStatus::Online);
+            else if (st == "offline") app.getFleet().setStatus(p, PrinterStatus::Offline);
+            else if (st == "maintenance") app.getFleet().setStatus(p, PrinterStatus::Maintenance);
+            else if (st == "error") app.getFleet().tripBreaker(p, epochMs());
+            else return "bad printer state: " + w[2];
+        }
+        else if (cmd == "fault" && w.size() == 3) {
+            int p = atoi(w[1].c_str()) - 1;
+            if (p < 0 || p >= PRINTERS) return "no such printer: " + w[1];
+            app.getFleet().setFaultRate(p, atof(w[2].c_str()));
+        }
+        else if (cmd == "printers" && w.size() == 1) {
+            PrinterFleet& fleet = app.getFleet();
+            for (int p = 0; p < fleet.size(); p++)
+                out << (p + 1) << ' ' << PrinterFleet::statusName(fleet.status(p)) << ' '
+                    << fleet.unit(p).printed << ' ' << fleet.unit(p).interrupted << '\n';
+        }
+        else if (cmd == "import" && w.size() == 2) {
+            ifstream fin(w[1]);
+            if (!fin.is_open()) return "cannot open " + w[1];
+            // Check every line first so a bad one rejects the whole file.
+            struct Row { string type; int prio; string owner; };
+            vector<Row> rows;
+            string line;
+            while (getline(fin, line)) {
+                if (line.empty() || line == "\r") continue;
+                size_t a = line.find(','), b = a == string::npos ? a : line.find(',', a + 1);
+                int prio;
+                if (a == string::npos || !priority(line.substr(a + 1, b == string::npos ? string::npos : b - a - 1), prio))
+                    return "bad import line: " + line;
+                string owner = b == string::npos ? user : line.substr(b + 1);
+                if (!ownerName(owner) || owner != user) return "owner must be the signed-in user (" + user + "): " + line;
+                rows.push_back({ jobType(line.substr(0, a)), prio, owner });
+            }
+            int added = 0;
+            for (const Row& r : rows) {
+                if (app.submit(r.type, r.prio, r.owner).empty())
+                    return "queue is full after " + to_string(added) + " imports";
+                added++;
+            }
+            out << "imported " << added << '\n';
+        }
+        else return "bad command: " + cmd;
+        return "";
+    }
+
+    static int run(MinHeap& app, istream& in, const string& user) {
+        string line;
+        int lineNo = 0, failed = 0;
+        while (getline(in, line)) {
+            lineNo++;
+            istringstream ss(line);
+            vector<string> words;
+            string word;
+            while (ss >> word) words.push_back(word);
+            if (words.empty() || words[0][0] == '#') continue;
+            string err = execute(app, words, user, cout);
+            if (!err.empty()) {
+                cerr << "line " << lineNo << ": " << err << '\n';
+                failed++;
+            }
+        }
+        return failed ? 1 : 0;
+    }
+
+    static int main(int argc, char* argv[]) {
+        ios::sync_with_stdio(false);
+        string user = "system";
+        vector<string> words;
+        bool fromStdin = false, authenticated = false;
+        for (int i = 1; i < argc; i++) {
+            string a = argv[i];
+            if (a == "--user" && i + 1 < argc) { user = argv[++i]; authenticated = true; }
+            else if (a == "--batch" || a == "-") fromStdin = true;
+            else if (a == "--help" || a == "-h") { usage(); return 0; }
+            else words.push_back(a);
+        }
+        if (fromStdin == !words.empty()) { usage(); return 2; }
+        if (!ownerName(user)) { cerr << "bad user name: " << user << '\n'; return 2; }
+        if (authenticated) {
+            const char* password = getenv(PASSWORD_ENV);
+            UserStore users;
+            if (!password || !users.verify(user, password)) {
+                cerr << "authentication failed for " << user << " (password is read from $" PASSWORD_ENV ")\n";
+                return 2;
+            }
+        }
+
+        MinHeap app(user);
+        if (fromStdin) return run(app, cin, user);
+        string err = execute(app, words, user, cout);
+        if (!err.empty()) cerr << err << '\n';
+        return err.empty() ? 0 : 1;
+    }
+};
+
 // ==========================================
 //               MAIN MENU
 // ==========================================
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 2 && string(argv[1]) == "--bench") {
+        string which = argv[2];
+        if (which == "fairness") Benchmark::fairShare();
+        else if (which == "auth") Benchmark::authentication();
+        else if (which == "history") Benchmark::history(argc > 3 ? atoll(argv[3]) : 10000000);
+        else if (which == "faults") return Benchmark::faults();
+        else cout << "Unknown benchmark: " << which << " (fairness, auth, history, faults)\n";
+        return 0;
+    }
+    if (argc > 1) return Batch::main(argc, argv);
+
     UI::init();
 
     // Loading Animation
@@ -672,15 +2439,17 @@ int main() {
 
     // --- Authentication Loop ---
     bool authenticated = false;
+    string user;
+    UserStore users;
     while (!authenticated) {
         Menu authMenu("AUTHENTICATION", { "Login", "Sign Up", "Exit System" });
         int choice = authMenu.show();
 
         if (choice == 1) {
-            authenticated = login();
+            authenticated = login(users, user);
         }
         else if (choice == 2) {
-            signup();
+            signup(users);
         }
         else if (choice == 3) {
             cout << "Goodbye.\n";
@@ -688,7 +2457,8 @@ int main() {
         }
     }
 
-    MinHeap app;
+    MinHeap app(user);
+    for (int p = 0; p < PRINTERS; p++) app.getFleet().setFaultRate(p, FAULT_RATE);
 
     // --- Main Dashboard Loop ---
     while (true) {
@@ -701,6 +2471,7 @@ int main() {
             "Update Job (Prio/Status)",
             "List Pending Jobs",
             "RUN Simulation",
+            "Job History Report",
             "Theme Settings",
             "Save & Exit"
             });
@@ -723,7 +2494,10 @@ int main() {
         case 5:
             app.processJobs();
             break;
-        case 6: {
+        case 6:
+            app.historyReport();
+            break;
+        case 7: {
             Menu themeMenu("SELECT THEME", { "Modern (Default)", "Classic (Green)", "Light Mode", "Dark Mode" });
             int t = themeMenu.show();
             if (t == 1) {
@@ -740,7 +2514,7 @@ int main() {
             }
             break;
         }
-        case 7:
+        case 8:
             UI::clear();
             UI::centerText("Saving Data...", 10);
             this_thread::sleep_for(chrono::milliseconds(500));